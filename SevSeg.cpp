@@ -100,6 +100,9 @@ SevSeg::SevSeg() {
   waitOffTime = 0;
   waitOffActive = false;
   numDigits = 0;
+  numSegmentGroups = 1;
+  digitsPerGroup = 0;
+  numLongGroups = 1;
   prevUpdateIdx = 0;
   prevUpdateTime = 0;
   resOnSegments = 0;
@@ -117,9 +120,15 @@ SevSeg::SevSeg() {
 // leadingZerosIn indicates whether leading zeros should be displayed
 // disableDecPoint is true when the decimal point segment is not connected, in
 // which case there are only 7 segments.
+// numSegmentGroupsIn is the number of separate segment buses (up to
+// MAXSEGMENTGROUPS). The digits are split in order between the groups, with
+// earlier groups getting any extra digit. segmentPinsIn holds the segment pins
+// of each group one after the other. One digit from each group is lit at the
+// same time, so each digit is on for a larger share of the time.
 void SevSeg::begin(uint8_t hardwareConfig, uint8_t numDigitsIn, const uint8_t digitPinsIn[],
                    const uint8_t segmentPinsIn[], bool resOnSegmentsIn,
-                   bool updateWithDelaysIn, bool leadingZerosIn, bool disableDecPoint) {
+                   bool updateWithDelaysIn, bool leadingZerosIn, bool disableDecPoint,
+                   uint8_t numSegmentGroupsIn) {
 
   resOnSegments = resOnSegmentsIn;
   updateWithDelays = updateWithDelaysIn;
@@ -130,6 +139,17 @@ void SevSeg::begin(uint8_t hardwareConfig, uint8_t numDigitsIn, const uint8_t di
   //Limit the max number of digits to prevent overflowing
   if (numDigits > MAXNUMDIGITS) numDigits = MAXNUMDIGITS;
 
+  // Each segment group must serve at least one digit
+  numSegmentGroups = numSegmentGroupsIn;
+  if (numSegmentGroups > MAXSEGMENTGROUPS) numSegmentGroups = MAXSEGMENTGROUPS;
+  if (numSegmentGroups > numDigits) numSegmentGroups = numDigits;
+  if (numSegmentGroups < 1) numSegmentGroups = 1;
+  // Split the digits in order. When they don't divide evenly, the first
+  // (numDigits % numSegmentGroups) groups get one extra digit each.
+  digitsPerGroup = (numDigits + numSegmentGroups - 1) / numSegmentGroups;
+  numLongGroups = numDigits % numSegmentGroups;
+  if (numLongGroups == 0) numLongGroups = numSegmentGroups;
+
   switch (hardwareConfig) {
 
     case 0: // Common cathode
@@ -167,8 +187,10 @@ void SevSeg::begin(uint8_t hardwareConfig, uint8_t numDigitsIn, const uint8_t di
   }
 
   // Save the input pin numbers to library variables
-  for (uint8_t segmentNum = 0 ; segmentNum < numSegments ; segmentNum++) {
-    segmentPins[segmentNum] = segmentPinsIn[segmentNum];
+  for (uint8_t group = 0 ; group < numSegmentGroups ; group++) {
+    for (uint8_t segmentNum = 0 ; segmentNum < numSegments ; segmentNum++) {
+      segmentPins[group][segmentNum] = segmentPinsIn[group * numSegments + segmentNum];
+    }
   }
 
   for (uint8_t digitNum = 0 ; digitNum < numDigits ; digitNum++) {
@@ -181,9 +203,11 @@ void SevSeg::begin(uint8_t hardwareConfig, uint8_t numDigitsIn, const uint8_t di
     digitalWrite(digitPins[digit], digitOffVal);
   }
 
-  for (uint8_t segmentNum = 0 ; segmentNum < numSegments ; segmentNum++) {
-    pinMode(segmentPins[segmentNum], OUTPUT);
-    digitalWrite(segmentPins[segmentNum], segmentOffVal);
+  for (uint8_t group = 0 ; group < numSegmentGroups ; group++) {
+    for (uint8_t segmentNum = 0 ; segmentNum < numSegments ; segmentNum++) {
+      pinMode(segmentPins[group][segmentNum], OUTPUT);
+      digitalWrite(segmentPins[group][segmentNum], segmentOffVal);
+    }
   }
 
   blank(); // Initialise the display
@@ -201,7 +225,9 @@ void SevSeg::begin(uint8_t hardwareConfig, uint8_t numDigitsIn, const uint8_t di
 //    to the next segment.
 // For resistors on *segments* we will cycle through all __ # of digits,
 //    turning on the *segments* as appropriate for a given digit, before moving on
-//    to the next digit.
+//    to the next digit. When there are multiple segment groups, one digit from
+//    each group is turned on at the same time, so only 'digitsPerGroup' steps
+//    are needed to cycle through all digits.
 // If using update delays, refreshDisplay has a delay between each digit/segment
 //    as it cycles through. It exits with all LEDs off.
 // If not using updateDelays, refreshDisplay exits with a single digit/segment
@@ -265,7 +291,7 @@ void SevSeg::refreshDisplay() {
       }
 
       prevUpdateIdx++;
-      if (prevUpdateIdx >= numDigits) prevUpdateIdx = 0;
+      if (prevUpdateIdx >= digitsPerGroup) prevUpdateIdx = 0;
 
       // Illuminate the required segments for the new digit
       digitOn(prevUpdateIdx);
@@ -294,7 +320,7 @@ void SevSeg::refreshDisplay() {
     else {
       /**********************************************/
       // RESISTORS ON SEGMENTS, UPDATE WITH DELAYS
-      for (uint8_t digitNum = 0 ; digitNum < numDigits ; digitNum++) {
+      for (uint8_t digitNum = 0 ; digitNum < digitsPerGroup ; digitNum++) {
 
         // Illuminate the required segments for this digit
         digitOn(digitNum);
@@ -314,10 +340,12 @@ void SevSeg::refreshDisplay() {
 
 // segmentOn
 /******************************************************************************/
-// Turns a segment on, as well as all corresponding digit pins
-// (according to digitCodes[])
+// Turns a segment on (in every segment group), as well as all corresponding
+// digit pins (according to digitCodes[])
 void SevSeg::segmentOn(uint8_t segmentNum) {
-  digitalWrite(segmentPins[segmentNum], segmentOnVal);
+  for (uint8_t group = 0 ; group < numSegmentGroups ; group++) {
+    digitalWrite(segmentPins[group][segmentNum], segmentOnVal);
+  }
   for (uint8_t digitNum = 0 ; digitNum < numDigits ; digitNum++) {
     if (digitCodes[digitNum] & (1 << segmentNum)) { // Check a single bit
       digitalWrite(digitPins[digitNum], digitOnVal);
@@ -327,35 +355,53 @@ void SevSeg::segmentOn(uint8_t segmentNum) {
 
 // segmentOff
 /******************************************************************************/
-// Turns a segment off, as well as all digit pins
+// Turns a segment off (in every segment group), as well as all digit pins
 void SevSeg::segmentOff(uint8_t segmentNum) {
   for (uint8_t digitNum = 0 ; digitNum < numDigits ; digitNum++) {
     digitalWrite(digitPins[digitNum], digitOffVal);
   }
-  digitalWrite(segmentPins[segmentNum], segmentOffVal);
+  for (uint8_t group = 0 ; group < numSegmentGroups ; group++) {
+    digitalWrite(segmentPins[group][segmentNum], segmentOffVal);
+  }
 }
 
 // digitOn
 /******************************************************************************/
-// Turns a digit on, as well as all corresponding segment pins
-// (according to digitCodes[])
+// Turns a digit on in each segment group, as well as all corresponding segment
+// pins (according to digitCodes[]). digitNum is the position within the group.
 void SevSeg::digitOn(uint8_t digitNum) {
-  digitalWrite(digitPins[digitNum], digitOnVal);
-  for (uint8_t segmentNum = 0 ; segmentNum < numSegments ; segmentNum++) {
-    if (digitCodes[digitNum] & (1 << segmentNum)) { // Check a single bit
-      digitalWrite(segmentPins[segmentNum], segmentOnVal);
+  uint8_t firstDigit = 0; // The first digit of the current group
+  for (uint8_t group = 0 ; group < numSegmentGroups ; group++) {
+    uint8_t groupSize = (group < numLongGroups) ? digitsPerGroup : digitsPerGroup - 1;
+    if (digitNum < groupSize) { // Later groups may have one less digit
+      uint8_t digit = firstDigit + digitNum;
+      digitalWrite(digitPins[digit], digitOnVal);
+      for (uint8_t segmentNum = 0 ; segmentNum < numSegments ; segmentNum++) {
+        if (digitCodes[digit] & (1 << segmentNum)) { // Check a single bit
+          digitalWrite(segmentPins[group][segmentNum], segmentOnVal);
+        }
+      }
     }
+    firstDigit += groupSize;
   }
 }
 
 // digitOff
 /******************************************************************************/
-// Turns a digit off, as well as all segment pins
+// Turns a digit off in each segment group, as well as all segment pins
+// digitNum is the position within the group.
 void SevSeg::digitOff(uint8_t digitNum) {
-  for (uint8_t segmentNum = 0 ; segmentNum < numSegments ; segmentNum++) {
-    digitalWrite(segmentPins[segmentNum], segmentOffVal);
+  uint8_t firstDigit = 0; // The first digit of the current group
+  for (uint8_t group = 0 ; group < numSegmentGroups ; group++) {
+    for (uint8_t segmentNum = 0 ; segmentNum < numSegments ; segmentNum++) {
+      digitalWrite(segmentPins[group][segmentNum], segmentOffVal);
+    }
+    uint8_t groupSize = (group < numLongGroups) ? digitsPerGroup : digitsPerGroup - 1;
+    if (digitNum < groupSize) {
+      digitalWrite(digitPins[firstDigit + digitNum], digitOffVal);
+    }
+    firstDigit += groupSize;
   }
-  digitalWrite(digitPins[digitNum], digitOffVal);
 }
 
 // setBrightness
@@ -13,6 +13,10 @@
 #define MAXNUMDIGITS 8 // Can be increased, but the max number is 2^31
 #endif
 
+#ifndef MAXSEGMENTGROUPS
+#define MAXSEGMENTGROUPS 1 // Number of separate segment buses. Increase to use segment groups
+#endif
+
 #ifndef SevSeg_h
 #define SevSeg_h
 
@@ -40,7 +44,7 @@ public:
   void begin(uint8_t hardwareConfig, uint8_t numDigitsIn, const uint8_t digitPinsIn[],
           const uint8_t segmentPinsIn[], bool resOnSegmentsIn=0,
           bool updateWithDelaysIn=0, bool leadingZerosIn=0,
-		  bool disableDecPoint=0);
+		  bool disableDecPoint=0, uint8_t numSegmentGroupsIn=1);
   void setBrightness(int16_t brightnessIn); // A number from 0..100
 
   void setNumber(int32_t numToShow, int8_t decPlaces=-1, bool hex=0);
@@ -66,9 +70,12 @@ private:
   uint8_t digitOnVal,digitOffVal,segmentOnVal,segmentOffVal;
   bool resOnSegments, updateWithDelays, leadingZeros;
   uint8_t digitPins[MAXNUMDIGITS];
-  uint8_t segmentPins[8];
+  uint8_t segmentPins[MAXSEGMENTGROUPS][8];
   uint8_t numDigits;
   uint8_t numSegments;
+  uint8_t numSegmentGroups; // The number of separate segment buses
+  uint8_t digitsPerGroup; // The number of digits served by the largest segment bus
+  uint8_t numLongGroups; // Groups with digitsPerGroup digits. The rest have one less
   uint8_t prevUpdateIdx; // The previously updated segment or digit
   uint8_t digitCodes[MAXNUMDIGITS]; // The active setting of each segment of each digit
   uint32_t prevUpdateTime; // The time (millis()) when the display was last updated
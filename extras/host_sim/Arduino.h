@@ -0,0 +1,25 @@
+/* SevSeg Library - host simulation stubs
+ *
+ * A minimal stand-in for Arduino.h so that SevSeg.cpp can be compiled and run
+ * on a PC. Pin writes are recorded and time is controlled by the simulation.
+ * See host_sim.cpp.
+ */
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+
+#define LOW 0
+#define HIGH 1
+#define OUTPUT 1
+
+#define constrain(amt, low, high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+uint32_t micros(void);
+void delayMicroseconds(unsigned int us);
+
+#endif //Arduino_h
@@ -0,0 +1,113 @@
+/* SevSeg Library - host simulation
+ *
+ * Runs refreshDisplay() against simulated pins and checks, for each digit:
+ *  - the fraction of time that it is lit (1 / number of steps per cycle)
+ *  - that its segments are driven from its own segment group's bus
+ *
+ * Build and run from the library folder:
+ *   g++ -DARDUINO=100 -DMAXSEGMENTGROUPS=4 -I extras/host_sim -I . \
+ *       extras/host_sim/host_sim.cpp SevSeg.cpp -o host_sim && ./host_sim
+ */
+
+#include "SevSeg.h"
+#include <stdio.h>
+#include <math.h>
+
+#if MAXSEGMENTGROUPS < 4
+#error "Build with -DMAXSEGMENTGROUPS=4 (see above)"
+#endif
+
+#define NUM_PINS 64
+#define FIRST_SEGMENT_PIN 16 // Digit pins are 0..7, group g segments follow
+#define TIME_STEP 10 // us between calls to refreshDisplay()
+#define SIM_TIME 1000000UL // us
+#define DUTY_TOLERANCE 0.01
+
+static uint8_t pinVals[NUM_PINS];
+static uint32_t simTime;
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t pin, uint8_t val) { pinVals[pin] = val; }
+uint32_t micros(void) { return simTime; }
+void delayMicroseconds(unsigned int us) { simTime += us; }
+
+// Returns the segment group that serves digitNum. The first
+// (numDigits % numGroups) groups have one extra digit.
+static uint8_t expectedGroup(uint8_t digitNum, uint8_t numDigits, uint8_t numGroups) {
+  uint8_t firstDigit = 0;
+  for (uint8_t group = 0 ; group < numGroups ; group++) {
+    uint8_t groupSize = numDigits / numGroups + (group < numDigits % numGroups ? 1 : 0);
+    if (digitNum < firstDigit + groupSize) return group;
+    firstDigit += groupSize;
+  }
+  return numGroups;
+}
+
+// Simulates a common cathode display with resistors on segments, where digit
+// pin d is 'd' and segment s of group g is 'FIRST_SEGMENT_PIN + 8*g + s'.
+// Returns the number of failed checks.
+static int runCase(uint8_t numDigits, uint8_t numGroups) {
+  uint8_t digitPins[MAXNUMDIGITS];
+  uint8_t segmentPins[8 * MAXSEGMENTGROUPS];
+  uint8_t segs[MAXNUMDIGITS];
+  for (uint8_t digitNum = 0 ; digitNum < numDigits ; digitNum++) {
+    digitPins[digitNum] = digitNum;
+    segs[digitNum] = digitNum + 1; // A different pattern for every digit
+  }
+  for (uint8_t pin = 0 ; pin < 8 * numGroups ; pin++) {
+    segmentPins[pin] = FIRST_SEGMENT_PIN + pin;
+  }
+
+  SevSeg sevseg;
+  sevseg.begin(COMMON_CATHODE, numDigits, digitPins, segmentPins, true,
+               false, false, false, numGroups);
+  sevseg.setSegments(segs);
+
+  uint32_t onTime[MAXNUMDIGITS] = {0};
+  uint32_t wrongSegments = 0;
+  for (simTime = 0 ; simTime < SIM_TIME ; simTime += TIME_STEP) {
+    sevseg.refreshDisplay();
+    for (uint8_t digitNum = 0 ; digitNum < numDigits ; digitNum++) {
+      if (pinVals[digitNum] != LOW) continue; // Digit is off
+      onTime[digitNum] += TIME_STEP;
+      // The lit segments of this digit's group must show this digit
+      uint8_t group = expectedGroup(digitNum, numDigits, numGroups);
+      uint8_t litSegs = 0;
+      for (uint8_t segmentNum = 0 ; segmentNum < 8 ; segmentNum++) {
+        if (pinVals[FIRST_SEGMENT_PIN + 8 * group + segmentNum] == HIGH) {
+          litSegs |= 1 << segmentNum;
+        }
+      }
+      if (litSegs != segs[digitNum]) wrongSegments++;
+    }
+  }
+
+  uint8_t stepsPerCycle = (numDigits + numGroups - 1) / numGroups;
+  double expectedDuty = 1.0 / stepsPerCycle;
+  int failures = 0;
+  printf("%u digits, %u group(s): expected duty %.3f\n", numDigits, numGroups, expectedDuty);
+  for (uint8_t digitNum = 0 ; digitNum < numDigits ; digitNum++) {
+    double duty = (double)onTime[digitNum] / SIM_TIME;
+    bool ok = fabs(duty - expectedDuty) <= DUTY_TOLERANCE;
+    printf("  digit %u: duty %.3f %s\n", digitNum, duty, ok ? "ok" : "FAIL");
+    if (!ok) failures++;
+  }
+  if (wrongSegments) {
+    printf("  FAIL: %lu samples with wrong segments\n", (unsigned long)wrongSegments);
+    failures++;
+  }
+  return failures;
+}
+
+int main() {
+  int failures = 0;
+  failures += runCase(8, 1);
+  failures += runCase(8, 2);
+  failures += runCase(7, 2); // Uneven split: 4 + 3
+  failures += runCase(6, 4); // Uneven split: 2 + 2 + 1 + 1
+  printf(failures ? "FAILED\n" : "PASSED\n");
+  return failures ? 1 : 0;
+}